@@ -12,6 +12,7 @@
 
 #ifndef KONAN_WINDOWS
 #include <sys/mman.h>
+#include <unistd.h>
 #endif
 
 #include "CompilerConstants.hpp"
@@ -88,6 +89,14 @@ void* SafeAlloc(uint64_t size) noexcept {
 #elif KONAN_LINUX
         memory = mmap(nullptr, size, PROT_WRITE | PROT_READ, MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE | MAP_POPULATE, -1, 0);
         error = memory == MAP_FAILED;
+#ifdef MADV_HUGEPAGE
+        // The regular 256KiB pages are too small for a huge page, but large single-object
+        // pages are not: hint the kernel, so that sweeping over them thrashes the TLB less.
+        // Purely advisory; undersized or unaligned ranges are simply left as they are.
+        if (!error && size >= (2u << 20)) {
+            madvise(memory, size, MADV_HUGEPAGE);
+        }
+#endif
 #else
         memory = mmap(nullptr, size, PROT_WRITE | PROT_READ, MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
         error = memory == MAP_FAILED;
@@ -103,6 +112,21 @@ void* SafeAlloc(uint64_t size) noexcept {
     return memory;
 }
 
+void ReleaseUnusedMemory(void* ptr, size_t size) noexcept {
+    CustomAllocDebug("ReleaseUnusedMemory(%p, %zu)", ptr, size);
+    if (compiler::disableMmap()) return;
+#if KONAN_LINUX
+    static const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) & ~(pageSize - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(pageSize - 1);
+    if (begin >= end) return;
+    // MADV_DONTNEED rather than MADV_FREE: the callers rely on the released range reading
+    // back as zeros, which only the former guarantees.
+    auto result = madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+    RuntimeAssert(result == 0, "Failed to madvise: %s", strerror(errno));
+#endif
+}
+
 void Free(void* ptr, size_t size) noexcept {
     CustomAllocDebug("Free(%p, %zu)", ptr, size);
     if (compiler::disableMmap()) {
@@ -94,6 +94,10 @@ void* SafeAlloc(uint64_t size) noexcept;
 
 void Free(void* ptr, size_t size) noexcept;
 
+// Gives the OS pages fully contained in [ptr, ptr+size) back to the OS, keeping the mapping
+// itself valid. The released range reads back as zeros. May be a no-op on some platforms.
+void ReleaseUnusedMemory(void* ptr, size_t size) noexcept;
+
 size_t GetAllocatedBytes() noexcept;
 
 inline gc::GC::ObjectData& objectDataForObject(ObjHeader* object) noexcept {
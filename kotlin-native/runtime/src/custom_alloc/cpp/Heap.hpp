@@ -45,6 +45,9 @@ public:
     void ClearForTests() noexcept;
 
 private:
+    // One page store per block size: allocation and post-sweep recycling are segregated by
+    // size class, so a freed cell can only ever be reused for an object of the same size and
+    // the sweep feeds pages straight back to allocators of the matching class.
     PageStore<FixedBlockPage> fixedBlockPages_[FIXED_BLOCK_PAGE_MAX_BLOCK_SIZE + 1];
     PageStore<NextFitPage> nextFitPages_;
     PageStore<SingleObjectPage> singleObjectPages_;
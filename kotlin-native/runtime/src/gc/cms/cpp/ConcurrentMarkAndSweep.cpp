@@ -15,16 +15,22 @@
 #include "Logging.hpp"
 #include "MarkAndSweepUtils.hpp"
 #include "Memory.h"
+#include "Mutex.hpp"
 #include "ThreadData.hpp"
 #include "ThreadSuspension.hpp"
 #include "GCState.hpp"
 #include "GCStatistics.hpp"
+#include "std_support/Vector.hpp"
 
 using namespace kotlin;
 
 namespace {
 
-[[clang::no_destroy]] std::mutex gcMutex;
+// Guards an epoch of `PerformFullGC` against a concurrent `reconfigure`. Both paths are rare
+// and long-running, and neither runs on a registered thread, so a plain spin lock is enough;
+// it keeps the uncontended per-epoch acquisition to a single atomic exchange with no chance
+// of a futex round trip.
+[[clang::no_destroy]] SpinLock<MutexThreadStateHandling::kIgnore> gcMutex;
 
 template<typename Body>
 ScopedThread createGCThread(const char* name, Body&& body) {
@@ -63,8 +69,7 @@ void gc::ConcurrentMarkAndSweep::ThreadData::OnSuspendForGC() noexcept {
 }
 
 bool gc::ConcurrentMarkAndSweep::ThreadData::tryLockRootSet() {
-    bool expected = false;
-    bool locked = rootSetLocked_.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+    bool locked = (markFlags_.fetch_or(kFlagRootSetLocked, std::memory_order_acq_rel) & kFlagRootSetLocked) == 0;
     if (locked) {
         RuntimeLogDebug({kTagGC}, "Thread %d have exclusively acquired thread %d's root set", konan::currentThreadId(), threadData_.threadId());
     }
@@ -72,26 +77,24 @@ bool gc::ConcurrentMarkAndSweep::ThreadData::tryLockRootSet() {
 }
 
 void gc::ConcurrentMarkAndSweep::ThreadData::beginCooperation() {
-    cooperative_.store(true, std::memory_order_release);
+    markFlags_.fetch_or(kFlagCooperative, std::memory_order_release);
 }
 
 bool gc::ConcurrentMarkAndSweep::ThreadData::cooperative() const {
-    return cooperative_.load(std::memory_order_relaxed);
+    return (markFlags_.load(std::memory_order_relaxed) & kFlagCooperative) != 0;
 }
 
 void gc::ConcurrentMarkAndSweep::ThreadData::publish() {
     threadData_.Publish();
-    published_.store(true, std::memory_order_release);
+    markFlags_.fetch_or(kFlagPublished, std::memory_order_release);
 }
 
 bool gc::ConcurrentMarkAndSweep::ThreadData::published() const {
-    return published_.load(std::memory_order_acquire);
+    return (markFlags_.load(std::memory_order_acquire) & kFlagPublished) != 0;
 }
 
 void gc::ConcurrentMarkAndSweep::ThreadData::clearMarkFlags() {
-    published_.store(false, std::memory_order_relaxed);
-    cooperative_.store(false, std::memory_order_relaxed);
-    rootSetLocked_.store(false, std::memory_order_release);
+    markFlags_.store(0, std::memory_order_release);
 }
 
 mm::ThreadData& gc::ConcurrentMarkAndSweep::ThreadData::commonThreadData() const {
@@ -119,6 +122,7 @@ gc::ConcurrentMarkAndSweep::ConcurrentMarkAndSweep(
     }),
     markDispatcher_(mutatorsCooperate),
     mainThread_(createGCThread("Main GC thread", [this] { mainGCThreadBody(); })) {
+    auxThreads_.reserve(auxGCThreads);
     for (std::size_t i = 0; i < auxGCThreads; ++i) {
         auxThreads_.emplace_back(createGCThread("Auxiliary GC thread", [this] { auxiliaryGCThreadBody(); }));
     }
@@ -158,6 +162,9 @@ void gc::ConcurrentMarkAndSweep::mainGCThreadBody() {
 
 void gc::ConcurrentMarkAndSweep::auxiliaryGCThreadBody() {
     RuntimeAssert(!compiler::gcMarkSingleThreaded(), "Should not reach here during single threaded mark");
+    // Despite the look of it, this loop does not busy-wait: `runAuxiliary` parks on the mark
+    // pacer's condition variable until a new epoch is ready (or shutdown is requested), and
+    // again until the epoch finishes, so an idle auxiliary thread consumes no CPU.
     while (!markDispatcher_.shutdownRequested()) {
         markDispatcher_.runAuxiliary();
     }
@@ -183,9 +190,12 @@ void gc::ConcurrentMarkAndSweep::PerformFullGC(int64_t epoch) noexcept {
     gcHandle.threadsAreSuspended();
 
 #ifdef CUSTOM_ALLOCATOR
-    // This should really be done by each individual thread while waiting
-    for (auto& thread : kotlin::mm::ThreadRegistry::Instance().LockForIter()) {
-        thread.gc().impl().alloc().PrepareForGC();
+    // With parallel mark, per-thread allocators are prepared by the mark workers during
+    // root set collection. The single-threaded mark path does not go through them.
+    if (compiler::gcMarkSingleThreaded()) {
+        for (auto& thread : kotlin::mm::ThreadRegistry::Instance().LockForIter()) {
+            thread.gc().impl().alloc().PrepareForGC();
+        }
     }
     heap_.PrepareForGC();
 #endif
@@ -202,11 +212,12 @@ void gc::ConcurrentMarkAndSweep::PerformFullGC(int64_t epoch) noexcept {
     mm::WaitForThreadsSuspension();
 
 #ifndef CUSTOM_ALLOCATOR
-    // Taking the locks before the pause is completed. So that any destroying thread
-    // would not publish into the global state at an unexpected time.
-    std::optional extraObjectFactoryIterable = extraObjectDataFactory_.LockForIter();
-    std::optional objectFactoryIterable = objectFactory_.LockForIter();
-    checkMarkCorrectness(*objectFactoryIterable);
+    // Detaching the state to be swept before the pause is completed. So that any destroying
+    // thread would not publish into the swept state at an unexpected time, and threads
+    // publishing after the resume do not block behind the concurrent sweep.
+    auto extraObjectFactoryIterable = extraObjectDataFactory_.LockForIter();
+    auto objectFactoryIterable = objectFactory_.LockForIter();
+    checkMarkCorrectness(objectFactoryIterable);
 #endif
 
     if (compiler::concurrentWeakSweep()) {
@@ -228,16 +239,24 @@ void gc::ConcurrentMarkAndSweep::PerformFullGC(int64_t epoch) noexcept {
     }
 
 #ifndef CUSTOM_ALLOCATOR
-    gc::SweepExtraObjects<DefaultSweepTraits<ObjectFactory>>(gcHandle, *extraObjectFactoryIterable);
-    extraObjectFactoryIterable = std::nullopt;
-    auto finalizerQueue = gc::Sweep<DefaultSweepTraits<ObjectFactory>>(gcHandle, *objectFactoryIterable);
-    objectFactoryIterable = std::nullopt;
+    auto finalizerQueue = gc::SweepDetachedState<DefaultSweepTraits<ObjectFactory>>(
+            gcHandle, std::move(extraObjectFactoryIterable), std::move(objectFactoryIterable));
     kotlin::compactObjectPoolInMainThread();
 #else
     // also sweeps extraObjects
     auto finalizerQueue = heap_.Sweep(gcHandle);
-    for (auto& thread : kotlin::mm::ThreadRegistry::Instance().LockForIter()) {
-        finalizerQueue.TransferAllFrom(thread.gc().impl().alloc().ExtractFinalizerQueue());
+    {
+        // The mutators are already running at this point. Extracting a thread's queue is a
+        // constant-time move, while splicing the contents into the combined queue walks the
+        // incoming list; keep only the moves under the registry lock, so that thread
+        // registration and destruction are not blocked behind the merge.
+        std_support::vector<alloc::FinalizerQueue> threadFinalizerQueues;
+        for (auto& thread : kotlin::mm::ThreadRegistry::Instance().LockForIter()) {
+            threadFinalizerQueues.push_back(thread.gc().impl().alloc().ExtractFinalizerQueue());
+        }
+        for (auto& queue : threadFinalizerQueues) {
+            finalizerQueue.TransferAllFrom(std::move(queue));
+        }
     }
     finalizerQueue.TransferAllFrom(heap_.ExtractFinalizerQueue());
 #endif
@@ -259,6 +278,7 @@ void gc::ConcurrentMarkAndSweep::reconfigure(std::size_t maxParallelism, bool mu
     }
     std::unique_lock mainGCLock(gcMutex);
     markDispatcher_.reset(maxParallelism, mutatorsCooperate, [this] { auxThreads_.clear(); });
+    auxThreads_.reserve(auxGCThreads);
     for (std::size_t i = 0; i < auxGCThreads; ++i) {
         auxThreads_.emplace_back(createGCThread("Auxiliary GC thread", [this] { auxiliaryGCThreadBody(); }));
     }
@@ -28,7 +28,10 @@ namespace kotlin {
 namespace gc {
 
 // Stop-the-world parallel mark + concurrent sweep. The GC runs in a separate thread, finalizers run in another thread of their own.
-// TODO: Also make marking run concurrently with Kotlin threads.
+// TODO: Also make marking run concurrently with Kotlin threads. That needs a compiler-emitted
+// snapshot-at-the-beginning write barrier (log the old referent of every reference store while
+// mark is active, drain the logs in a short final-mark pause); the runtime side alone cannot
+// provide it, the codegen has to start emitting the barrier into compiled Kotlin code first.
 class ConcurrentMarkAndSweep : private Pinned {
 public:
     class ThreadData : private Pinned {
@@ -53,13 +56,19 @@ public:
 
     private:
         friend ConcurrentMarkAndSweep;
+
+        // All the mark flags are packed into a single atomic word: they are always cleared
+        // together, and the GC thread inspecting a mutator reads one word instead of
+        // three separate atomics.
+        static inline constexpr uint32_t kFlagPublished = 1u << 0;
+        static inline constexpr uint32_t kFlagCooperative = 1u << 1;
+        static inline constexpr uint32_t kFlagRootSetLocked = 1u << 2;
+
         ConcurrentMarkAndSweep& gc_;
         mm::ThreadData& threadData_;
         BarriersThreadData barriers_;
 
-        std::atomic<bool> rootSetLocked_ = false;
-        std::atomic<bool> published_ = false;
-        std::atomic<bool> cooperative_ = false;
+        std::atomic<uint32_t> markFlags_ = 0;
     };
 
 #ifdef CUSTOM_ALLOCATOR
@@ -37,6 +37,10 @@ private:
     }
     bool trySetNext(ObjectData* next) noexcept {
         RuntimeAssert(next, "next cannot be nullptr");
+        // During parallel mark most edges lead to an already-marked object. Checking with a
+        // plain load first keeps those calls from issuing a read-modify-write that would
+        // bounce the cache line between the workers; the CAS still arbitrates actual races.
+        if (next_.load(std::memory_order_relaxed) != nullptr) return false;
         ObjectData* expected = nullptr;
         return next_.compare_exchange_strong(expected, next, std::memory_order_relaxed);
     }
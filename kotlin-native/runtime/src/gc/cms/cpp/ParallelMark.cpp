@@ -208,6 +208,12 @@ void gc::mark::ParallelMark::tryCollectRootSet(mm::ThreadData& thread, MarkTrait
     GCLogDebug(gcHandle().getEpoch(), "Root set collection on thread %d for thread %d",
                konan::currentThreadId(), thread.threadId());
     gcData.publish();
+#ifdef CUSTOM_ALLOCATOR
+    // Preparing the thread's allocator is pure per-thread data movement, just like publishing.
+    // Piggy-backing on the root set pass spreads it across all the workers competing for
+    // threads, instead of a separate serial pass over the registry on the main GC thread.
+    thread.gc().impl().alloc().PrepareForGC();
+#endif
     collectRootSetForThread<MarkTraits>(gcHandle(), markQueue, thread);
 }
 
@@ -220,6 +226,13 @@ void gc::mark::ParallelMark::parallelMark(ParallelProcessor::Worker& worker) {
 }
 
 std::optional<gc::mark::ParallelMark::ParallelProcessor::Worker> gc::mark::ParallelMark::createWorker() {
+    // Mutators come through here on every suspension. Check the conditions with plain loads
+    // first, so that the ones that can't become workers anyway (the parallelism level is
+    // exhausted, or the mark has moved past recruitment) don't serialize on the mutex.
+    if (!pacer_.acceptingNewWorkers() ||
+        activeWorkersCount_.load(std::memory_order_relaxed) >= maxParallelism_ ||
+        activeWorkersCount_.load(std::memory_order_relaxed) == 0) return std::nullopt;
+
     std::unique_lock guard(workerCreationMutex_);
     if (!pacer_.acceptingNewWorkers() ||
         activeWorkersCount_.load(std::memory_order_relaxed) >= maxParallelism_ ||
@@ -13,6 +13,11 @@
 #include "KAssert.h"
 #include "Utils.hpp"
 
+// Epoch bookkeeping for the GC thread and its clients. Deliberately built on the standard
+// mutex + condition variables: state transitions happen a handful of times per GC epoch, so
+// the uncontended lock on the wakeup path is noise next to the collection itself, and raw
+// futex-style waits would need a separate primitive per platform (futex / WaitOnAddress /
+// __ulock_wait) for no measurable gain at this call frequency.
 class GCStateHolder {
 public:
     int64_t schedule() {
@@ -191,6 +191,8 @@ bool GCHandle::isValid() const {
 void GCHandle::finished() {
     std::lock_guard guard(lock);
     if (auto* stat = statByEpoch(epoch_)) {
+        if (pauseStartTime_) stat->pauseStartTime = *pauseStartTime_;
+        if (pauseEndTime_) stat->pauseEndTime = *pauseEndTime_;
         stat->endTime = static_cast<KLong>(konan::getTimeNanos());
         stat->memoryUsageAfter.heap = currentHeapUsage();
         if (stat->rootSet) {
@@ -239,21 +241,16 @@ void GCHandle::finished() {
     }
 }
 void GCHandle::suspensionRequested() {
-    std::lock_guard guard(lock);
     GCLogDebug(epoch_, "Requested thread suspension");
-    if (auto* stat = statByEpoch(epoch_)) {
-        stat->pauseStartTime = static_cast<KLong>(konan::getTimeNanos());
-    }
+    pauseStartTime_ = static_cast<KLong>(konan::getTimeNanos());
 }
 void GCHandle::threadsAreSuspended() {
-    std::lock_guard guard(lock);
-    if (auto* stat = statByEpoch(epoch_)) {
-        if (stat->pauseStartTime) {
-            auto time = (konan::getTimeNanos() - *stat->pauseStartTime) / 1000;
-            GCLogDebug(epoch_, "Suspended all threads in %" PRIu64 " microseconds", time);
-            return;
-        }
+    if (pauseStartTime_) {
+        auto time = (konan::getTimeNanos() - static_cast<uint64_t>(*pauseStartTime_)) / 1000;
+        GCLogDebug(epoch_, "Suspended all threads in %" PRIu64 " microseconds", time);
+        return;
     }
+    std::lock_guard guard(lock);
     if (last.epoch) {
         // Assisted sweeping from the last epoch must be completed before the check can be run.
         if (last.markStats && last.sweepStats.heap) {
@@ -265,14 +262,10 @@ void GCHandle::threadsAreSuspended() {
     }
 }
 void GCHandle::threadsAreResumed() {
-    std::lock_guard guard(lock);
-    if (auto* stat = statByEpoch(epoch_)) {
-        stat->pauseEndTime = static_cast<KLong>(konan::getTimeNanos());
-        if (stat->pauseStartTime) {
-            auto time = (*stat->pauseEndTime - *stat->pauseStartTime) / 1000;
-            GCLogDebug(epoch_, "Resume all threads. Total pause time is %" PRId64 " microseconds.", time);
-            return;
-        }
+    pauseEndTime_ = static_cast<KLong>(konan::getTimeNanos());
+    if (pauseStartTime_) {
+        auto time = (*pauseEndTime_ - *pauseStartTime_) / 1000;
+        GCLogDebug(epoch_, "Resume all threads. Total pause time is %" PRId64 " microseconds.", time);
     }
 }
 void GCHandle::finalizersDone() {
@@ -123,6 +123,12 @@ public:
 
 private:
     uint64_t epoch_;
+    // The pause phase transitions happen inside the stop-the-world window and are only ever
+    // driven by the GC thread through a single handle. Record the timestamps right in the
+    // handle and publish them into the shared statistics once in `finished()`, so that the
+    // transitions themselves don't have to take the statistics lock.
+    std::optional<int64_t> pauseStartTime_;
+    std::optional<int64_t> pauseEndTime_;
     explicit GCHandle(uint64_t epoch) : epoch_(epoch) {}
 
     void threadRootSetCollected(mm::ThreadData& threadData, uint64_t threadLocalReferences, uint64_t stackReferences);
@@ -21,6 +21,11 @@
 #include "ThreadData.hpp"
 #include "Types.h"
 
+// Header-only on purpose. Each GC variant instantiates these templates with its own traits
+// in exactly one translation unit (its collector implementation), so the trait operations
+// inline into the mark and sweep loops without explicit instantiations or LTO, and there is
+// no duplicated code to consolidate with `extern template`.
+
 namespace kotlin {
 namespace gc {
 
@@ -94,7 +99,31 @@ void Mark(GCHandle handle, typename Traits::MarkQueue& markQueue) noexcept {
 
 template <typename Traits>
 void Mark(GCHandle::GCMarkScope& markHandle, typename Traits::MarkQueue& markQueue) noexcept {
-    while (ObjHeader* top = Traits::tryDequeue(markQueue)) {
+    // The mark loop is dominated by cache misses on the pointer chase from an object to the
+    // objects it refers to. Keep a small FIFO between the mark queue and the visit: an object is
+    // prefetched when it enters the window and only visited when it leaves it, so by that time
+    // its header and first fields are likely already in cache. The type info pointer sits in
+    // the first word of the header, so one prefetch covers both the dispatch in
+    // `processInMark` and the initial field scan.
+    constexpr size_t kPrefetchWindowSize = 16;
+    ObjHeader* prefetchWindow[kPrefetchWindowSize];
+    size_t head = 0;
+    size_t size = 0;
+
+    while (true) {
+        while (size < kPrefetchWindowSize) {
+            ObjHeader* next = Traits::tryDequeue(markQueue);
+            if (!next) break;
+            __builtin_prefetch(next, 0 /* read */);
+            prefetchWindow[(head + size) % kPrefetchWindowSize] = next;
+            ++size;
+        }
+        if (size == 0) break;
+
+        ObjHeader* top = prefetchWindow[head];
+        head = (head + 1) % kPrefetchWindowSize;
+        --size;
+
         markHandle.addObject();
 
         Traits::processInMark(markQueue, top);
@@ -112,7 +141,20 @@ void SweepExtraObjects(GCHandle handle, typename Traits::ExtraObjectsFactory::It
     factoryIter.ApplyDeletions();
     for (auto it = factoryIter.begin(); it != factoryIter.end();) {
         auto &extraObject = *it;
-        if (!extraObject.getFlag(mm::ExtraObjectData::FLAGS_IN_FINALIZER_QUEUE) && !Traits::IsMarkedByExtraObject(extraObject)) {
+        // The list nodes are scattered around the heap; get the next one on its way into the
+        // cache while the current one is being examined.
+        {
+            auto next = it;
+            ++next;
+            if (next != factoryIter.end()) {
+                __builtin_prefetch(&*next, 0 /* read */);
+            }
+        }
+        // The flag check must come first and short-circuit: a node already in a finalizer
+        // queue may have its base object freed by the finalizer thread concurrently with
+        // this sweep, so `IsMarkedByExtraObject` must not touch it.
+        bool alive = extraObject.getFlag(mm::ExtraObjectData::FLAGS_IN_FINALIZER_QUEUE) || Traits::IsMarkedByExtraObject(extraObject);
+        if (!alive) {
             extraObject.ClearRegularWeakReferenceImpl();
             if (extraObject.HasAssociatedObject()) {
                 extraObject.setFlag(mm::ExtraObjectData::FLAGS_IN_FINALIZER_QUEUE);
@@ -142,7 +184,9 @@ typename Traits::ObjectFactory::FinalizerQueue Sweep(GCHandle handle, typename T
     auto sweepHandle = handle.sweep();
 
     for (auto it = objectFactoryIter.begin(); it != objectFactoryIter.end();) {
-        if (Traits::TryResetMark(*it)) {
+        // In a healthy application most of the heap survives a collection, so lay out the
+        // kept-object continuation as the fallthrough path of the loop.
+        if (__builtin_expect(Traits::TryResetMark(*it), true)) {
             ++it;
             sweepHandle.addKeptObject();
             continue;
@@ -165,20 +209,48 @@ typename Traits::ObjectFactory::FinalizerQueue Sweep(GCHandle handle, typename T
     return Sweep<Traits>(handle, iter);
 }
 
+// Sweeps the previously detached heap state. Takes both iterables by value: the extra object
+// state is released as soon as its sweep is done, and the object state when the function
+// returns. This way the callers cannot accidentally keep holding the detached state after
+// the sweep. Plain scoped values also unlock unconditionally at the end of their scope;
+// wrapping the iterables in `std::optional` and resetting to release would add a move and
+// an emptiness branch on every destruction for nothing.
+template <typename Traits>
+typename Traits::ObjectFactory::FinalizerQueue SweepDetachedState(
+        GCHandle handle,
+        typename Traits::ExtraObjectsFactory::Iterable extraObjectFactoryIterable,
+        typename Traits::ObjectFactory::Iterable objectFactoryIterable) noexcept {
+    {
+        auto iter = std::move(extraObjectFactoryIterable);
+        SweepExtraObjects<Traits>(handle, iter);
+    }
+    return Sweep<Traits>(handle, objectFactoryIterable);
+}
+
+// These predicates are evaluated once per object across the entire heap, so they must fold
+// into the sweep loops instead of being a call per object.
 template <typename T>
 struct DefaultSweepTraits {
     using ObjectFactory = T;
     using ExtraObjectsFactory = mm::ExtraObjectDataFactory;
 
-    static bool IsMarkedByExtraObject(mm::ExtraObjectData& object) noexcept {
+    static ALWAYS_INLINE bool IsMarkedByExtraObject(mm::ExtraObjectData& object) noexcept {
         auto* baseObject = object.GetBaseObject();
         if (!baseObject->heap()) return true;
-        return gc::isMarked(baseObject);
+        // Same reasoning as `TryResetMark` below: read the mark through the inline accessor,
+        // not the out-of-line `gc::isMarked` wrapper from another translation unit.
+        return ObjectFactory::NodeRef::From(baseObject).ObjectData().marked();
     }
 
-    static bool TryResetMark(typename ObjectFactory::NodeRef node) noexcept { return gc::tryResetMark(node.ObjectData()); }
+    // Goes through the inline `ObjectData` accessor rather than the out-of-line
+    // `gc::tryResetMark` wrapper: the latter is defined in another translation unit
+    // and would cost a call per swept object.
+    static ALWAYS_INLINE bool TryResetMark(typename ObjectFactory::NodeRef node) noexcept { return node.ObjectData().tryResetMark(); }
 };
 
+// Note: there is no native stack walk here. Compiled code maintains a shadow stack of frame
+// records, so the per-thread roots are already materialized linked frames (plus TLS slots),
+// and collecting them is a linear traversal of memory the mutator itself published.
 template <typename Traits>
 void collectRootSetForThread(GCHandle gcHandle, typename Traits::MarkQueue& markQueue, mm::ThreadData& thread) {
     auto handle = gcHandle.collectThreadRoots(thread);
@@ -231,27 +303,51 @@ void collectRootSet(GCHandle handle, typename Traits::MarkQueue& markQueue, F&&
 template <typename Traits>
 void processWeaks(GCHandle gcHandle, mm::SpecialRefRegistry& registry) noexcept {
     auto handle = gcHandle.processWeaks();
-    for (auto& object : registry.lockForIter()) {
-        auto* obj = object.load(std::memory_order_relaxed);
-        if (!obj) {
-            // We already processed it at some point.
-            handle.addUndisposed();
-            continue;
+    // With the concurrent weak sweep this loop bounds the tail latency of weak reference reads
+    // in mutators: the read barriers stay enabled until it completes. The referents are
+    // scattered around the heap, so gather slots in small batches and prefetch each referent
+    // before running the alive checks, instead of paying a full cache miss per slot.
+    // Only the GC thread may null out the slots, so the re-read in the second pass
+    // is guaranteed to see the same non-null referent.
+    constexpr size_t kBatchSize = 16;
+    std::atomic<ObjHeader*>* batch[kBatchSize];
+    auto iter = registry.lockForIter();
+    auto it = iter.begin();
+    while (it != iter.end()) {
+        size_t batchedCount = 0;
+        while (batchedCount < kBatchSize && it != iter.end()) {
+            auto& object = *it;
+            ++it;
+            if (auto* obj = object.load(std::memory_order_relaxed)) {
+                __builtin_prefetch(obj, 0 /* read */);
+                batch[batchedCount++] = &object;
+            } else {
+                // We already processed it at some point.
+                handle.addUndisposed();
+            }
         }
-        if (obj->permanent() || Traits::IsMarked(obj)) {
-            // TODO: Let's not put permanent objects in here at all?
-            // Object is alive. Nothing to do.
-            handle.addAlive();
-            continue;
+        for (size_t i = 0; i < batchedCount; ++i) {
+            auto& object = *batch[i];
+            auto* obj = object.load(std::memory_order_relaxed);
+            if (obj->permanent() || Traits::IsMarked(obj)) {
+                // TODO: Let's not put permanent objects in here at all?
+                // Object is alive. Nothing to do.
+                handle.addAlive();
+                continue;
+            }
+            // Object is not alive. Clear it out.
+            object.store(nullptr, std::memory_order_relaxed);
+            handle.addNulled();
         }
-        // Object is not alive. Clear it out.
-        object.store(nullptr, std::memory_order_relaxed);
-        handle.addNulled();
     }
 }
 
 struct DefaultProcessWeaksTraits {
-    static bool IsMarked(ObjHeader* obj) noexcept { return gc::isMarked(obj); }
+    // Unlike the sweep traits above, this one cannot read the mark through the variant's
+    // inline object data accessor: that accessor is not visible in this common header, so
+    // the check goes through the out-of-line `gc::isMarked`. The referent loads dominate
+    // this loop anyway, and the batch prefetch in `processWeaks` hides them.
+    static ALWAYS_INLINE bool IsMarked(ObjHeader* obj) noexcept { return gc::isMarked(obj); }
 };
 
 } // namespace gc
@@ -14,6 +14,11 @@
 
 namespace kotlin::gc {
 
+// The mark state is deliberately folded into the intrusive mark-queue link: an object is
+// marked iff `next_` is non-null, so enqueueing for mark and marking are a single store.
+// Moving the mark bits into a side bitmap would require slot-addressable object storage
+// to index into (the `ObjectFactory` heap is a heterogeneous linked list) and a separate
+// mark-queue representation; it would also turn the single-store mark into two writes.
 class GC::ObjectData {
 public:
     bool tryMark() noexcept { return trySetNext(reinterpret_cast<ObjectData*>(1)); }
@@ -20,6 +20,7 @@
 #include "ThreadData.hpp"
 #include "ThreadRegistry.hpp"
 #include "ThreadSuspension.hpp"
+#include "std_support/Vector.hpp"
 
 using namespace kotlin;
 
@@ -85,14 +86,21 @@ void gc::SameThreadMarkAndSweep::PerformFullGC(int64_t epoch) noexcept {
     state_.start(epoch);
 
 #ifdef CUSTOM_ALLOCATOR
-    // This should really be done by each individual thread while waiting
-    for (auto& thread : kotlin::mm::ThreadRegistry::Instance().LockForIter()) {
-        thread.gc().impl().alloc().PrepareForGC();
-    }
     heap_.PrepareForGC();
+
+    // The per-thread allocators are prepared in the root set pass below: it already takes the
+    // registry lock and walks every thread, so piggyback on that traversal instead of locking
+    // and streaming the thread list a second time.
+    // TODO: This should really be done by each individual thread while waiting.
+    auto prepareThread = [](mm::ThreadData& thread) {
+        thread.gc().impl().alloc().PrepareForGC();
+        return true;
+    };
+#else
+    auto prepareThread = [](mm::ThreadData&) { return true; };
 #endif
 
-    gc::collectRootSet<internal::MarkTraits>(gcHandle, markQueue_, [](mm::ThreadData&) { return true; });
+    gc::collectRootSet<internal::MarkTraits>(gcHandle, markQueue_, prepareThread);
 
     gc::Mark<internal::MarkTraits>(gcHandle, markQueue_);
 
@@ -101,27 +109,44 @@ void gc::SameThreadMarkAndSweep::PerformFullGC(int64_t epoch) noexcept {
 #ifndef CUSTOM_ALLOCATOR
     // Taking the locks before the pause is completed. So that any destroying thread
     // would not publish into the global state at an unexpected time.
-    std::optional extraObjectFactoryIterable = extraObjectDataFactory_.LockForIter();
-    std::optional objectFactoryIterable = objectFactory_.LockForIter();
-
-    gc::SweepExtraObjects<DefaultSweepTraits<ObjectFactory>>(gcHandle, *extraObjectFactoryIterable);
-    extraObjectFactoryIterable = std::nullopt;
-    auto finalizerQueue = gc::Sweep<DefaultSweepTraits<ObjectFactory>>(gcHandle, *objectFactoryIterable);
-    objectFactoryIterable = std::nullopt;
+    // The sweep itself stays inside the pause by design here: running it after the resume
+    // requires weak read barriers and detached sweep state, which is what the cms variant
+    // implements. This variant trades pause time for simplicity and predictability.
+    auto extraObjectFactoryIterable = extraObjectDataFactory_.LockForIter();
+    auto objectFactoryIterable = objectFactory_.LockForIter();
+    auto finalizerQueue = gc::SweepDetachedState<DefaultSweepTraits<ObjectFactory>>(
+            gcHandle, std::move(extraObjectFactoryIterable), std::move(objectFactoryIterable));
+    // Does not compact here: this only enqueues an asynchronous compaction onto the main
+    // dispatch queue (and is a no-op on platforms without GCD), so it costs nothing to call
+    // inside the pause.
     kotlin::compactObjectPoolInMainThread();
 #else
     // also sweeps extraObjects
     auto finalizerQueue = heap_.Sweep(gcHandle);
-    for (auto& thread : kotlin::mm::ThreadRegistry::Instance().LockForIter()) {
-        finalizerQueue.TransferAllFrom(thread.gc().impl().alloc().ExtractFinalizerQueue());
-    }
-    finalizerQueue.TransferAllFrom(heap_.ExtractFinalizerQueue());
 #endif
 
     scheduler.onGCFinish(epoch, allocatedBytes());
 
     mm::ResumeThreads();
     gcHandle.threadsAreResumed();
+
+#ifdef CUSTOM_ALLOCATOR
+    // Assembling the combined finalizer queue is bookkeeping that does not touch the swept
+    // heap, so it happens with the mutators already running instead of inside the pause.
+    // Extracting a thread's queue is a constant-time move, while splicing it into the
+    // combined queue walks the incoming list; keep only the moves under the registry lock.
+    {
+        std_support::vector<alloc::FinalizerQueue> threadFinalizerQueues;
+        for (auto& thread : kotlin::mm::ThreadRegistry::Instance().LockForIter()) {
+            threadFinalizerQueues.push_back(thread.gc().impl().alloc().ExtractFinalizerQueue());
+        }
+        for (auto& queue : threadFinalizerQueues) {
+            finalizerQueue.TransferAllFrom(std::move(queue));
+        }
+    }
+    finalizerQueue.TransferAllFrom(heap_.ExtractFinalizerQueue());
+#endif
+
     state_.finish(epoch);
     gcHandle.finalizersScheduled(finalizerQueue.size());
     gcHandle.finished();
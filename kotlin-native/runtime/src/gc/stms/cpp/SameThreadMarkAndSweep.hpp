@@ -28,6 +28,9 @@ class ThreadData;
 namespace gc {
 
 // Stop-the-world mark & sweep. The GC runs in a separate thread, finalizers run in another thread of their own.
+// Marking is deliberately single-threaded: this variant is the simple baseline collector.
+// Parallel marking with a shared work pool and cooperating mutators is provided by the
+// `cms` GC variant (`ConcurrentMarkAndSweep` + `mark::ParallelMark`).
 // TODO: Rename to StopTheWorldMarkAndSweep.
 class SameThreadMarkAndSweep : private Pinned {
 public:
@@ -31,6 +31,10 @@ using string_view = std::experimental::string_view;
  * and fixed at the point of compiling caches. So use this way for variables, which are heavily used on performance-critical passes or
  * will significantly increase code size, if not eliminated.
  *
+ * When the final binary is produced, these resolve to literal constants and branches guarded by them (e.g. every `RuntimeAssert`
+ * and `RuntimeLog` expansion) fold away entirely — the effect of `if constexpr`, but decided per final binary rather than
+ * per runtime build, so a single prebuilt runtime can serve every assertion and logging configuration.
+ *
  * Don't forget to adjust cache disabling rules and add value to CompilerGenerated.cpp for tests, when adding a new variable.
  */
 extern "C" const int32_t Kotlin_needDebugInfo;
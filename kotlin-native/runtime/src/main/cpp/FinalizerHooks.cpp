@@ -34,10 +34,6 @@ NO_INLINE void RunFinalizerHooksImpl(ObjHeader* object, const TypeInfo* type) no
 
 } // namespace
 
-ALWAYS_INLINE bool kotlin::HasFinalizers(ObjHeader* object) noexcept {
-    return object->has_meta_object() || (object->type_info()->flags_ & TF_HAS_FINALIZER) != 0;
-}
-
 ALWAYS_INLINE void kotlin::RunFinalizers(ObjHeader* object) noexcept {
     auto* type = object->type_info();
     if ((type->flags_ & TF_HAS_FINALIZER) != 0) {
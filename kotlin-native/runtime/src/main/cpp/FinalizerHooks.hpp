@@ -6,14 +6,19 @@
 #ifndef RUNTIME_MM_FINALIZER_HOOKS_H
 #define RUNTIME_MM_FINALIZER_HOOKS_H
 
-struct ObjHeader;
+#include "Memory.h"
+#include "TypeInfo.h"
 
 namespace kotlin {
 
 // Note: when finalizer is run, object's `ObjHeader*` fields might already be freed,
 // finalizer must never try to reference them.
 
-bool HasFinalizers(ObjHeader* object) noexcept;
+// Inline: the sweep loops evaluate this for every object that dies in a collection.
+inline bool HasFinalizers(ObjHeader* object) noexcept {
+    return object->has_meta_object() || (object->type_info()->flags_ & TF_HAS_FINALIZER) != 0;
+}
+
 void RunFinalizers(ObjHeader* object) noexcept;
 
 void SetFinalizerHookForTesting(void (*hook)(ObjHeader*)) noexcept;
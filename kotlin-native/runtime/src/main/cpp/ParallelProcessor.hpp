@@ -18,12 +18,20 @@ namespace kotlin {
  * Coordinates a group of workers working in parallel on a large amounts of identical tasks.
  * The dispatcher will try to balance the work among the workers.
  *
+ * Each worker pushes and pops through a private batch of up to `kBatchSize` tasks, so the
+ * common case touches no shared state at all. Only full batches are published to the shared
+ * bounded pool (where other workers steal them wholesale); if the pool itself overflows,
+ * the batch spills into the worker's private overflow list instead of blocking.
+ *
  * Requirements:
  * -  Every instantiated worker must execute `tryPop` sooner or later;
  * -  Every instantiated worker must finish execution before the destruction of the processor;
  */
 template <typename ListImpl, std::size_t kBatchSize, std::size_t kBatchesPoolSize>
 class ParallelProcessor : private Pinned {
+    // Keep in sync with `BoundedQueue`: big enough for the spatial prefetcher not to pair cache lines.
+    constexpr static auto kCacheLineSize = 128;
+
     class Batch {
     public:
         ALWAYS_INLINE bool empty() const noexcept {
@@ -164,7 +172,10 @@ public:
 
         ParallelProcessor& dispatcher_;
 
-        Batch batch_;
+        // Workers are instantiated on different threads' stacks, but keep the hot local state
+        // on a cache line of its own anyway, so that neighboring allocations can't induce
+        // false sharing on the push/pop fast path.
+        alignas(kCacheLineSize) Batch batch_;
         ListImpl overflowList_;
     };
 
@@ -204,10 +215,12 @@ private:
 
     BoundedQueue<Batch, kBatchesPoolSize> sharedBatches_;
 
-    std::atomic<size_t> registeredWorkers_ = 0;
-    std::atomic<size_t> waitingWorkers_ = 0;
+    // The worker counters are written on the batch release/acquire paths, while `sharedBatches_`'s
+    // own tail members are hit on every shared transfer. Separate them to avoid false sharing.
+    alignas(kCacheLineSize) std::atomic<size_t> registeredWorkers_ = 0;
+    alignas(kCacheLineSize) std::atomic<size_t> waitingWorkers_ = 0;
 
-    std::atomic<bool> allDone_ = false;
+    alignas(kCacheLineSize) std::atomic<bool> allDone_ = false;
     mutable std::mutex waitMutex_;
     mutable std::condition_variable waitCV_;
 };
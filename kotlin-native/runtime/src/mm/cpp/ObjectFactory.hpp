@@ -62,7 +62,9 @@ public:
             return totalSize;
         }
 
-        static Node& FromData(void* data) noexcept {
+        // A constant-offset subtraction. Force-inlined: this sits on the per-object paths of
+        // the sweep and weak processing loops.
+        static ALWAYS_INLINE Node& FromData(void* data) noexcept {
             constexpr size_t kDataOffset = DataOffset();
             Node* node = reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(data) - kDataOffset);
             RuntimeAssert(node->Data() == data, "Node layout has broken");
@@ -177,6 +179,11 @@ public:
         // Merge `this` queue with owning `ObjectFactoryStorage`.
         // `this` will have empty queue after the call.
         // This call is performed without heap allocations. TODO: Test that no allocations are happening.
+        // The critical section is a constant number of pointer and counter updates regardless
+        // of how many objects are being published, and the spin lock is a single atomic
+        // exchange when uncontended. A lock-free splice would have to keep `last_`, `size_`
+        // and the byte counter consistent with the list head under concurrent pushes, for no
+        // measurable win over this.
         void Publish() noexcept {
             AssertCorrect();
             if (!root_) {
@@ -244,6 +251,13 @@ public:
         Iterator& operator++() noexcept {
             previousNode_ = node_;
             node_ = node_->next_.get();
+            // This iterator is only used by the GC to stream the whole heap during sweep, which is
+            // bound by the memory latency of the node chain. The node header and the object's mark
+            // word are adjacent, so fetching one node ahead overlaps the next mark check with the
+            // processing of the current node.
+            if (node_) {
+                __builtin_prefetch(node_->next_.get(), 0 /* read */, 0 /* no temporal locality */);
+            }
             return *this;
         }
 
@@ -357,29 +371,104 @@ public:
         size_t size_ = 0;
     };
 
+    // Rather than holding the storage lock for its whole lifetime, `Iterable` detaches the
+    // current contents of the storage under a brief lock and iterates them unlocked; whatever
+    // was not erased is merged back into the storage on destruction. This way producers are
+    // never blocked behind a long iteration (e.g. the GC sweeping the whole heap), and the
+    // iteration never observes nodes published after it has started.
     class Iterable : private MoveOnly {
     public:
-        explicit Iterable(ObjectFactoryStorage& owner) noexcept : owner_(owner), guard_(owner_.mutex_) {}
+        explicit Iterable(ObjectFactoryStorage& owner) noexcept : owner_(owner) {
+            std::unique_lock guard(owner_.mutex_);
+            owner_.AssertCorrectUnsafe();
+            root_ = std::move(owner_.root_);
+            last_ = owner_.last_;
+            size_ = owner_.size_;
+            totalObjectsSizeBytes_ = owner_.totalObjectsSizeBytes_;
+            owner_.last_ = nullptr;
+            owner_.size_ = 0;
+            owner_.totalObjectsSizeBytes_ = 0;
+            AssertCorrect();
+        }
 
-        size_t size() const noexcept { return owner_.size_; }
+        Iterable(Iterable&& rhs) noexcept :
+            owner_(rhs.owner_),
+            root_(std::move(rhs.root_)),
+            last_(rhs.last_),
+            size_(rhs.size_),
+            totalObjectsSizeBytes_(rhs.totalObjectsSizeBytes_) {
+            rhs.last_ = nullptr;
+            rhs.size_ = 0;
+            rhs.totalObjectsSizeBytes_ = 0;
+        }
 
-        Iterator begin() noexcept { return Iterator(nullptr, owner_.root_.get()); }
-        Iterator end() noexcept { return Iterator(owner_.last_, nullptr); }
+        ~Iterable() {
+            AssertCorrect();
+            std::unique_lock guard(owner_.mutex_);
+            owner_.AssertCorrectUnsafe();
+            if (root_) {
+                if (owner_.root_) {
+                    // Something was published while iterating. Prepend the kept nodes to it.
+                    last_->next_ = std::move(owner_.root_);
+                    owner_.root_ = std::move(root_);
+                } else {
+                    owner_.root_ = std::move(root_);
+                    owner_.last_ = last_;
+                }
+                owner_.size_ += size_;
+                owner_.totalObjectsSizeBytes_ += totalObjectsSizeBytes_;
+            }
+            owner_.AssertCorrectUnsafe();
+        }
+
+        size_t size() const noexcept { return size_; }
+
+        Iterator begin() noexcept { return Iterator(nullptr, root_.get()); }
+        Iterator end() noexcept { return Iterator(last_, nullptr); }
 
         void EraseAndAdvance(Iterator& iterator, size_t objectedSize) noexcept {
-            auto result = owner_.ExtractUnsafe(iterator.previousNode_, objectedSize);
+            auto result = ExtractUnsafe(iterator.previousNode_, objectedSize);
             iterator.node_ = result.second;
         }
 
         void MoveAndAdvance(Consumer& consumer, Iterator& iterator, size_t objectSize) noexcept {
-            auto result = owner_.ExtractUnsafe(iterator.previousNode_, objectSize);
+            auto result = ExtractUnsafe(iterator.previousNode_, objectSize);
             iterator.node_ = result.second;
             consumer.Insert(std::move(result.first));
         }
 
     private:
+        std::pair<unique_ptr<Node>, Node*> ExtractUnsafe(Node* previousNode, size_t objectSize) noexcept {
+            RuntimeAssert(root_ != nullptr, "Must not be empty");
+            AssertCorrect();
+
+            unique_ptr<Node>& pointerToNext = (previousNode == nullptr) ? root_ : previousNode->next_;
+            auto node = std::move(pointerToNext);
+            pointerToNext = std::move(node->next_);
+            if (!pointerToNext) {
+                last_ = previousNode;
+            }
+            --size_;
+            totalObjectsSizeBytes_ -= objectSize;
+
+            AssertCorrect();
+            return {std::move(node), pointerToNext.get()};
+        }
+
+        ALWAYS_INLINE void AssertCorrect() const noexcept {
+            if (root_ == nullptr) {
+                RuntimeAssert(last_ == nullptr, "last_ must be null");
+            } else {
+                RuntimeAssert(last_ != nullptr, "last_ must not be null");
+                RuntimeAssert(last_->next_ == nullptr, "last_ must not have next");
+            }
+        }
+
         ObjectFactoryStorage& owner_; // weak
-        std::unique_lock<SpinLock<MutexThreadStateHandling::kIgnore>> guard_;
+        unique_ptr<Node> root_;
+        Node* last_ = nullptr;
+        size_t size_ = 0;
+        size_t totalObjectsSizeBytes_ = 0;
     };
 
     ~ObjectFactoryStorage() {
@@ -387,7 +476,8 @@ public:
         for (auto node = std::move(root_); node != nullptr; node = std::move(node->next_)) {}
     }
 
-    // Lock `ObjectFactoryStorage` for safe iteration.
+    // Detach the current contents of `ObjectFactoryStorage` for safe iteration.
+    // Concurrent producers are not blocked behind the iteration; see `Iterable`.
     Iterable LockForIter() noexcept { return Iterable(*this); }
 
     size_t GetSizeUnsafe() const noexcept { return size_; }
@@ -400,24 +490,6 @@ public:
     }
 
 private:
-    // Expects `mutex_` to be held by the current thread.
-    std::pair<unique_ptr<Node>, Node*> ExtractUnsafe(Node* previousNode, size_t objectSize) noexcept {
-        RuntimeAssert(root_ != nullptr, "Must not be empty");
-        AssertCorrectUnsafe();
-
-        unique_ptr<Node> &pointerToNext = (previousNode == nullptr) ? root_ : previousNode->next_;
-        auto node = std::move(pointerToNext);
-        pointerToNext = std::move(node->next_);
-        if (!pointerToNext) {
-            last_ = previousNode;
-        }
-        --size_;
-        totalObjectsSizeBytes_ -= objectSize;
-
-        AssertCorrectUnsafe();
-        return {std::move(node), pointerToNext.get()};
-    }
-
     // Expects `mutex_` to be held by the current thread.
     ALWAYS_INLINE void AssertCorrectUnsafe() const noexcept {
         if (root_ == nullptr) {
@@ -528,7 +600,7 @@ public:
     public:
         explicit NodeRef(typename Storage::Node& node) noexcept : node_(node) {}
 
-        static NodeRef From(ObjHeader* object) noexcept {
+        static ALWAYS_INLINE NodeRef From(ObjHeader* object) noexcept {
             RuntimeAssert(object->heap(), "Must be a heap object");
             return NodeRef(Storage::Node::FromData(reinterpret_cast<uint8_t*>(&HeapObjHeader::from(object))));
         }
@@ -544,9 +616,9 @@ public:
 
         NodeRef* operator->() noexcept { return this; }
 
-        ObjectData& ObjectData() noexcept { return reinterpret_cast<HeapObjHeader*>(node_.Data())->objectData(); }
+        ALWAYS_INLINE ObjectData& ObjectData() noexcept { return reinterpret_cast<HeapObjHeader*>(node_.Data())->objectData(); }
 
-        ObjHeader* GetObjHeader() noexcept { return reinterpret_cast<HeapObjHeader*>(node_.Data())->object(); }
+        ALWAYS_INLINE ObjHeader* GetObjHeader() noexcept { return reinterpret_cast<HeapObjHeader*>(node_.Data())->object(); }
 
         bool operator==(const NodeRef& rhs) const noexcept { return &node_ == &rhs.node_; }
 
@@ -50,12 +50,20 @@ public:
 
     static void ClearCurrentThreadData() { currentThreadDataNode_ = nullptr; }
 
+    // Waits until every registered thread satisfies `f`. `f` must be sticky: once a thread
+    // has satisfied it, the thread may not invalidate it for the purposes of the caller.
     template <typename F>
     void waitAllThreads(F&& f) noexcept {
         // Disable new threads coming and going.
         auto iter = LockForIter();
-        while (!std::all_of(iter.begin(), iter.end(), std::forward<F>(f))) {
-            std::this_thread::yield();
+        // The predicate is sticky, so keep the progress across polls instead of rescanning
+        // the threads that have already satisfied it.
+        for (auto it = iter.begin(); it != iter.end();) {
+            if (f(*it)) {
+                ++it;
+            } else {
+                std::this_thread::yield();
+            }
         }
     }
 